@@ -61,8 +61,8 @@ import ConvivaAppAnalytics
     
     func trackButtonClick(button:UIButton) {
         
-        let data = "{\"lable\": \(button.currentTitle!),\"property\": \(String(describing: type(of: button)))}"
-        CATAppAnalytics.defaultTracker()?.trackCustomEvent("button_click", data: data)
+        let eventData = ["lable": button.currentTitle ?? "", "property": String(describing: type(of: button))]
+        CATAppAnalytics.defaultTracker()?.trackCustomEvent("button_click", eventData: eventData)
     
     }
  